@@ -0,0 +1,370 @@
+/*---------------------------------------------------------------------------*\
+                               |
+  _____        _______ ____    | IWESOL: IWES Open Library
+ |_ _\ \      / / ____/ ___|   |
+  | | \ \ /\ / /|  _| \___ \   | Copyright: Fraunhofer Institute for Wind
+  | |  \ V  V / | |___ ___) |  | Energy and Energy System Technology IWES
+ |___|  \_/\_/  |_____|____/   |
+                               | http://www.iwes.fraunhofer.de
+                               |
+-------------------------------------------------------------------------------
+License
+    This file is part of IWESOL.
+
+    IWESOL is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IWESOL is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with IWESOL. If not, see <http://www.gnu.org/licenses/>.
+
+Application
+    blibBenchmark
+
+Description
+    Times the hot parts of blib, i.e., line path construction and
+    evaluation, derivative weights, hash tables, ordering and number
+    formatting, for sizes 10 ... maxSize. The results are written as
+    CSV with the columns
+
+        benchmark,size,operations,seconds,nsPerOperation
+
+    Usage: blibBenchmark [output.csv] [maxSize = 1000000]
+
+    Without output file the CSV is written to the console.
+
+\*---------------------------------------------------------------------------*/
+
+#include "GenericLinePath.h"
+#include "HashTable.h"
+#include "OrderedSet.h"
+#include "String.h"
+
+#include <cmath>
+#include <ctime>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+/// A plain 3D point for the line path benchmarks
+struct Vec3 {
+	Vec3(double x = 0, double y = 0, double z = 0): x(x), y(y), z(z) {}
+	Vec3 & operator+=(const Vec3 & rhs) { x += rhs.x; y += rhs.y; z += rhs.z; return *this; }
+	Vec3 & operator*=(double w) { x *= w; y *= w; z *= w; return *this; }
+	double x;
+	double y;
+	double z;
+};
+inline Vec3 operator+(const Vec3 & a, const Vec3 & b) { return Vec3(a.x + b.x, a.y + b.y, a.z + b.z); }
+inline Vec3 operator-(const Vec3 & a, const Vec3 & b) { return Vec3(a.x - b.x, a.y - b.y, a.z - b.z); }
+inline Vec3 operator*(double w, const Vec3 & a) { return Vec3(w * a.x, w * a.y, w * a.z); }
+inline Vec3 operator*(const Vec3 & a, double w) { return w * a; }
+inline Vec3 operator/(const Vec3 & a, double w) { return Vec3(a.x / w, a.y / w, a.z / w); }
+inline double mag(const Vec3 & a) { return std::sqrt(a.x * a.x + a.y * a.y + a.z * a.z); }
+inline double abs(const Vec3 & a) { return mag(a); }
+
+/// A set of doubles, ordered by blib::OrderedSet
+class DoubleSet:
+	public blib::OrderedSet<double>{
+
+public:
+
+	/// Constructor
+	DoubleSet(const std::vector<double> & values): values(values) {}
+
+	/// Ordered: Returns the number of elements
+	unsigned int size() const { return values.size(); }
+
+	/// OrderedSet: Returns element i before ordering
+	const double & getUnorderedElement(int i) const { return values[i]; }
+
+private:
+
+	/// The values
+	std::vector<double> values;
+};
+
+/// Reproducible pseudo random numbers in [0,1)
+class Random {
+
+public:
+
+	/// Constructor
+	Random(unsigned long seed = 12345): state(seed) {}
+
+	/// Returns the next number
+	inline double operator()() {
+		state = (1103515245UL * state + 12345UL) % 2147483648UL;
+		return double(state) / 2147483648.;
+	}
+
+private:
+
+	/// The state
+	unsigned long state;
+};
+
+/// A clock() based stop watch
+class StopWatch {
+
+public:
+
+	/// Constructor, starts the watch
+	StopWatch(): t0(std::clock()) {}
+
+	/// Returns the seconds since start
+	inline double seconds() const { return double(std::clock() - t0) / CLOCKS_PER_SEC; }
+
+private:
+
+	/// The start time
+	std::clock_t t0;
+};
+
+/// Writes the CSV header
+void writeHeader(std::ostream & out){
+	out << "benchmark,size,operations,seconds,nsPerOperation" << std::endl;
+}
+
+/// Writes one CSV row
+void writeRow(std::ostream & out, const std::string & name, long size, long ops, double seconds){
+	out << name << "," << size << "," << ops << "," << seconds << ","
+		<< (ops > 0 ? 1.e9 * seconds / ops : 0.) << std::endl;
+}
+
+/// Returns the number of repetitions for about minOps operations of size n
+inline long repetitions(long n, long minOps = 1000000){
+	return n >= minOps ? 1 : minOps / n;
+}
+
+/// Creates a wiggly line with n points
+std::vector<Vec3> createLine(long n){
+	std::vector<Vec3> out(n);
+	for(long i = 0; i < n; i++){
+		double t = double(i) / n;
+		out[i] = Vec3(i, std::sin(20 * t), std::cos(7 * t));
+	}
+	return out;
+}
+
+/// Line path construction from a point list, and point-wise
+void benchLinePathConstruction(std::ostream & out, long n){
+
+	// prepare:
+	std::vector<Vec3> pts = createLine(n);
+	long reps = repetitions(n);
+
+	// bulk:
+	StopWatch sw;
+	for(long r = 0; r < reps; r++){
+		blib::GenericLinePath<Vec3> path(pts);
+	}
+	writeRow(out,"linePath_construct_bulk",n,reps * n,sw.seconds());
+
+	// point-wise:
+	sw = StopWatch();
+	for(long r = 0; r < reps; r++){
+		blib::GenericLinePath<Vec3> path;
+		for(long i = 0; i < n; i++){
+			path.addPoint(pts[i]);
+		}
+	}
+	writeRow(out,"linePath_construct_addPoint",n,reps * n,sw.seconds());
+}
+
+/// Line path evaluation
+void benchLinePathEvaluation(std::ostream & out, long n, long evals){
+
+	// prepare:
+	blib::GenericLinePath<Vec3> path(createLine(n));
+	std::vector<double> sList(evals);
+	Random random;
+	for(long k = 0; k < evals; k++){
+		sList[k] = random();
+	}
+	Vec3 sum;
+	double ssum = 0;
+	int isum    = 0;
+
+	// operator[]:
+	StopWatch sw;
+	for(long k = 0; k < evals; k++){
+		sum += path[sList[k]];
+	}
+	writeRow(out,"linePath_operator[]",n,evals,sw.seconds());
+
+	// getTangent:
+	sw = StopWatch();
+	for(long k = 0; k < evals; k++){
+		sum += path.getTangent(sList[k]);
+	}
+	writeRow(out,"linePath_getTangent",n,evals,sw.seconds());
+
+	// getPointS:
+	sw = StopWatch();
+	for(long k = 0; k < evals; k++){
+		ssum += path.getPointS(k % n);
+	}
+	writeRow(out,"linePath_getPointS",n,evals,sw.seconds());
+
+	// toSubLine:
+	sw = StopWatch();
+	for(long k = 0; k < evals; k++){
+		double s = sList[k];
+		isum    += path.toSubLine(s);
+		ssum    += s;
+	}
+	writeRow(out,"linePath_toSubLine",n,evals,sw.seconds());
+
+	// sorted batch evaluation:
+	std::vector<double> sSorted(evals);
+	for(long k = 0; k < evals; k++){
+		sSorted[k] = double(k) / evals;
+	}
+	std::vector<Vec3> res(evals);
+	sw = StopWatch();
+	path.values(sSorted,res);
+	writeRow(out,"linePath_values",n,evals,sw.seconds());
+
+	// keep results alive:
+	if(mag(sum) + ssum + isum < 0) std::cout << "";
+}
+
+/// Derivative weights of the underlying grid, all cache misses
+void benchDerivWeights(std::ostream & out, long n, long evals){
+
+	// prepare:
+	blib::GenericLinePath<Vec3> path(createLine(n));
+	double l = path.length();
+	Random random;
+	double sum = 0;
+
+	// loop:
+	StopWatch sw;
+	for(long k = 0; k < evals; k++){
+		sum += path.getDerivWeights(l * random(),1,4).weights[0];
+	}
+	writeRow(out,"grid_getDerivWeights",n,evals,sw.seconds());
+
+	// keep results alive:
+	if(sum != sum) std::cout << "";
+}
+
+/// Hash table insertion and lookup
+void benchHashTable(std::ostream & out, long n){
+
+	// prepare:
+	std::vector<std::string> keys(n);
+	for(long i = 0; i < n; i++){
+		keys[i] = "key_" + blib::String(int(i));
+	}
+	blib::HashTable<long,std::string> table;
+	long sum = 0;
+
+	// insert:
+	StopWatch sw;
+	for(long i = 0; i < n; i++){
+		table.set(i,keys[i]);
+	}
+	writeRow(out,"hashTable_set",n,n,sw.seconds());
+
+	// find:
+	sw = StopWatch();
+	for(long i = 0; i < n; i++){
+		if(table.found(keys[n - 1 - i])){
+			sum += table[keys[n - 1 - i]];
+		}
+	}
+	writeRow(out,"hashTable_find",n,n,sw.seconds());
+
+	// keep results alive:
+	if(sum < 0) std::cout << "";
+}
+
+/// Ordering of random values
+void benchOrdered(std::ostream & out, long n){
+
+	// prepare:
+	std::vector<double> values(n);
+	Random random;
+	for(long i = 0; i < n; i++){
+		values[i] = random();
+	}
+	DoubleSet set(values);
+	long reps = repetitions(n);
+
+	// loop:
+	StopWatch sw;
+	for(long r = 0; r < reps; r++){
+		set.order();
+	}
+	writeRow(out,"ordered_order",n,reps * n,sw.seconds());
+}
+
+/// Number formatting
+void benchString(std::ostream & out, long n){
+
+	// prepare:
+	Random random;
+	std::vector<double> values(n);
+	for(long i = 0; i < n; i++){
+		values[i] = 1000. * random();
+	}
+	unsigned long chars = 0;
+
+	// double:
+	StopWatch sw;
+	for(long i = 0; i < n; i++){
+		chars += blib::String(values[i]).size();
+	}
+	writeRow(out,"string_double",n,n,sw.seconds());
+
+	// int:
+	sw = StopWatch();
+	for(long i = 0; i < n; i++){
+		chars += blib::String(int(i)).size();
+	}
+	writeRow(out,"string_int",n,n,sw.seconds());
+
+	// keep results alive:
+	if(chars == 0) std::cout << "";
+}
+
+}
+
+int main(int argc, char * argv[]){
+
+	// read arguments:
+	std::ofstream file;
+	if(argc > 1) file.open(argv[1]);
+	std::ostream & out = argc > 1 ? file : std::cout;
+	long maxSize       = argc > 2 ? std::atol(argv[2]) : 1000000;
+	if(!out){
+		std::cout << "\nblibBenchmark: Error: Cannot open '" << argv[1] << "'" << std::endl;
+		return 1;
+	}
+
+	// run:
+	bench::writeHeader(out);
+	for(long n = 10; n <= maxSize; n *= 10){
+		if(argc > 1) std::cout << "blibBenchmark: size " << n << std::endl;
+		bench::benchLinePathConstruction(out,n);
+		bench::benchLinePathEvaluation(out,n,100000);
+		bench::benchDerivWeights(out,n,100000);
+		bench::benchHashTable(out,n);
+		bench::benchOrdered(out,n);
+		bench::benchString(out,n);
+	}
+
+	return 0;
+}
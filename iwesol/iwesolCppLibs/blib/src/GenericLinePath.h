@@ -100,6 +100,18 @@ public:
 	 */
 	T derivative(double s, int m, int o = -1) const;
 
+	/** Evaluates the m-th derivative at each s of sList, 0 <= s <= 1, into
+	 * the preallocated out, i.e., out[i] = derivative(sList[i],m,o). The path
+	 * is walked once for ascending s, any other order is also valid.
+	 * SList and TList need operator[] and size(), e.g. std::vector.
+	 */
+	template <class SList, class TList>
+	void evaluate(const SList & sList, TList & out, int m = 0, int o = -1) const;
+
+	/// Evaluates the points at each s of sList, i.e., out[i] = (*this)[sList[i]], see evaluate
+	template <class SList, class TList>
+	inline void values(const SList & sList, TList & out) const { evaluate(sList,out,0,GenericRFunction<T>::getInterpolOrder()); }
+
 	/// UnstructuredGrid1D: shifts values
 	inline void shift(double deltas) { GenericRFunction<T>::shift(l(deltas)); }
 
@@ -115,6 +127,12 @@ public:
 	/// adds a data point at the end, same as addPoint
 	inline void append(const T & point) { addPoint(point); }
 
+	/** adds the points pts[i0] ... pts[i1 - 1] at the end, in one pass.
+	 * i1 = -1 corresponds to pts.size(). TList needs operator[] and size().
+	 */
+	template <class TList>
+	void addPoints(const TList & pts, int i0 = 0, int i1 = -1);
+
 	/// adds data points at the end
 	void append(const GenericLinePath<T> & path);
 
@@ -246,9 +264,7 @@ GenericLinePath<T>::GenericLinePath(
 		const std::string & name
 		):
 		GenericRFunction<T>(4,name){
-	for(unsigned int i = 0; i < points.size(); i++){
-		addPoint(points[i]);
-	}
+	addPoints(points);
 }
 
 template <class T>
@@ -276,27 +292,75 @@ inline T GenericLinePath<T>::derivative(double s, int m, int o) const {
 	return std::pow(length(),m) * GenericRFunction<T>::derivative(l(mods(s)),m,o);
 }
 
+template <class T>
+template <class SList, class TList>
+void GenericLinePath<T>::evaluate(const SList & sList, TList & out, int m, int o) const {
+
+	// trivial case, see derivative:
+	if(GenericRFunction<T>::size() == 2 && m > 0){
+		for(unsigned int i = 0; i < (unsigned int)(sList.size()); i++){
+			out[i] = derivative(sList[i],m,o);
+		}
+		return;
+	}
+
+	// prepare:
+	int cursor    = 0;
+	double factor = std::pow(length(),m);
+	UnstructuredGrid1D::DerivWeights dw;
+
+	// walk along the path:
+	for(unsigned int i = 0; i < (unsigned int)(sList.size()); i++){
+		out[i] = factor * GenericRFunction<T>::derivative(l(mods(sList[i])),m,o,cursor,dw);
+	}
+}
+
 template <class T>
 inline void GenericLinePath<T>::addPoint(const T & p){
 	double newl = GenericRFunction<T>::size() > 0 ? (length() + getDist(p,getEnd())) : 0.;
 	GenericRFunction<T>::add(newl,p);
 }
 
+template <class T>
+template <class TList>
+void GenericLinePath<T>::addPoints(const TList & pts, int i0, int i1){
+
+	// prepare:
+	if(i1 < 0) i1 = pts.size();
+	if(i1 <= i0) return;
+	int n = i1 - i0;
+	GenericRFunction<T>::reserve(GenericRFunction<T>::size() + n);
+
+	// segment lengths:
+	std::vector<double> l(n);
+	l[0] = GenericRFunction<T>::size() > 0 ? getDist(pts[i0],getEnd()) : 0.;
+	for(int i = 1; i < n; i++){
+		l[i] = getDist(pts[i0 + i],pts[i0 + i - 1]);
+	}
+
+	// cumulative lengths:
+	l[0] += GenericRFunction<T>::size() > 0 ? length() : 0.;
+	for(int i = 1; i < n; i++){
+		l[i] += l[i - 1];
+	}
+
+	// append:
+	for(int i = 0; i < n; i++){
+		GenericRFunction<T>::add(l[i],pts[i0 + i]);
+	}
+}
+
 template <class T>
 inline void GenericLinePath<T>::prepend(const T & point){
 	GenericLinePath<T> newlp;
 	newlp.addPoint(point);
-	for(unsigned int i = 0; i < GenericRFunction<T>::size(); i++){
-		newlp.addPoint(getPoint(i));
-	}
-	*this = newlp;
+	newlp.addPoints(getPointList());
+	GenericRFunction<T>::swap(newlp);
 }
 
 template <class T>
 inline void GenericLinePath<T>::append(const GenericLinePath<T> & path){
-	for(unsigned int i = 0; i < path.size(); i++){
-		addPoint(path.getPoint(i));
-	}
+	addPoints(path.getPointList());
 }
 
 /*
@@ -415,6 +479,7 @@ void GenericLinePath<T>::exportDerivative(GenericRFunction<T> & out, int m, int
 		out.points[i]  = s(out.points[i]);
 		out.data[i]   *= pow(length(),m);
 	}
+	out.clearDerivCache();
 
 }
 
@@ -437,18 +502,13 @@ int GenericLinePath<T>::toSubLine(double & s) const{
 	if(s <= 0) return 0;
 	if(s >= 1) return lines() - 1;
 
-	// find line:
-	double l     = s * GenericLinePath<T>::length();
-	int i        = 0;
-	double totl  = getLine(0).length();
-	double lastl = 0;
-	while( totl < l ) {
-		i++;
-		lastl = totl;
-		totl += getLine(i).length();
-	}
+	// find line by bisection:
+	double x = GenericRFunction<T>::getFirstPoint1D() + s * GenericLinePath<T>::length();
+	int i    = GenericRFunction<T>::getIndex_before(x);
+	if(i < 0) i = 0;
+	if(i >= int(lines())) i = lines() - 1;
 
-	s = (l - lastl) / getLine(i).length();
+	s = (x - GenericRFunction<T>::getPoint1D(i)) / getLine(i).length();
 	return i;
 
 }
@@ -42,9 +42,12 @@ References
 #ifndef GENERICRFUNCTION_H_
 #define GENERICRFUNCTION_H_
 
+#include <algorithm>
+
 #include "String.h"
 #include "GridDifferentiable1D.h"
 #include "UnstructuredGrid1D.h"
+#include "WeightedSum.h"
 
 namespace blib {
 
@@ -55,6 +58,9 @@ namespace blib {
  * Note: For non-trivial output the following functions are required to be specialized for T:
  * 			std::string GenericRFunction<T>::dataOutputDescription() const;
  * 			std::string GenericRFunction<T>::dataOutput(const T & t) const;
+ *
+ * Note: Specializations of WeightedSum for T must be declared before this
+ * header is included.
  */
 
 template <class T>
@@ -98,7 +104,7 @@ public:
 	inline std::string dataOutputDescription() const { return ""; }
 
 	/// GenericRFunction: Data output. Please specialize elsewhere!
-	inline std::string dataOutput(const T & t) const { return ""; }
+	inline std::string dataOutput(const T &) const { return ""; }
 
 	/// Outputable: Provides the data that will be written to the output file.
 	Outputable::OData getOData(
@@ -107,9 +113,25 @@ public:
 	/// adds a data point
 	void add(double xval, const T & yval);
 
+	/// Reserves storage for n data points
+	inline void reserve(unsigned int n) { UnstructuredGrid1D::reserve(n); data.reserve(n); }
+
 	/// GenericRFunction: Prints data
 	virtual void print() const;
 
+	/** GridDifferentiable1D: Returns the m-th derivative at x0, using
+	 * compile-time kernels for stencils of up to 8 points. The weights
+	 * are calculated into local storage, hence this is thread-safe.
+	 * o = -1 corresponds to maximal precision.
+	 */
+	virtual T derivative(double x0, int m, int o = -1) const;
+
+	/// as above, locating x0 by walking the cursor, see UnstructuredGrid1D::walkIndex_beforeeq
+	T derivative(double x0, int m, int o, int & cursor) const;
+
+	/// as above, calculating the weights into dw, such that its storage is reused between calls
+	T derivative(double x0, int m, int o, int & cursor, UnstructuredGrid1D::DerivWeights & dw) const;
+
 	/// GenericRFunction: Exports the m-th derivative, calculated to order o
 	virtual void exportDerivative(GenericRFunction<T> & out, int m, int o) const;
 
@@ -131,6 +153,9 @@ public:
 	/// The operator =
 	GenericRFunction<T> & operator=(const GenericRFunction<T> & rhs);
 
+	/// Exchanges the content with another function in O(1), e.g. instead of assigning a temporary
+	void swap(GenericRFunction<T> & other);
+
 	/// Reference to the Grid
 	inline const UnstructuredGrid1D & getGrid() const { return *this; }
 
@@ -159,7 +184,7 @@ public:
 	GenericRFunction<T> getSubFunction(double xlow, double xhigh, bool addEnds = true) const;
 
 	/// interpolate the function value, to interpolOrder
-	virtual T operator[](double x) const { return GridDifferentiable1D<T>::derivative(x,0,getInterpolOrder()); }
+	virtual T operator[](double x) const { return GenericRFunction<T>::derivative(x,0,getInterpolOrder()); }
 
 
 protected:
@@ -178,6 +203,13 @@ private:
 
 	/// The data
 	std::vector<T> data;
+
+	/// Returns the weighted data sum over the stencil
+	T stencilSum(const UnstructuredGrid1D::DerivWeights & dw) const;
+
+	/// Returns the weighted data sum over a stencil of N points
+	template <int N>
+	T stencilSum(const UnstructuredGrid1D::DerivWeights & dw) const;
 };
 
 template <class T>
@@ -234,6 +266,71 @@ GenericRFunction<T> & GenericRFunction<T>::operator=(const GenericRFunction<T> &
 	return *this;
 }
 
+template <class T>
+inline T GenericRFunction<T>::derivative(double x0, int m, int o) const{
+	UnstructuredGrid1D::DerivWeights dw;
+	calcDerivWeights(x0,m,o,dw);
+	return stencilSum(dw);
+}
+
+template <class T>
+inline T GenericRFunction<T>::derivative(double x0, int m, int o, int & cursor) const{
+	UnstructuredGrid1D::DerivWeights dw;
+	return derivative(x0,m,o,cursor,dw);
+}
+
+template <class T>
+inline T GenericRFunction<T>::derivative(double x0, int m, int o, int & cursor, UnstructuredGrid1D::DerivWeights & dw) const{
+	calcDerivWeights(x0,m,o,dw,&cursor);
+	return stencilSum(dw);
+}
+
+template <class T>
+T GenericRFunction<T>::stencilSum(const UnstructuredGrid1D::DerivWeights & dw) const{
+
+	// fixed size kernels:
+	switch(dw.domain.size()){
+		case 1: return stencilSum<1>(dw);
+		case 2: return stencilSum<2>(dw);
+		case 3: return stencilSum<3>(dw);
+		case 4: return stencilSum<4>(dw);
+		case 5: return stencilSum<5>(dw);
+		case 6: return stencilSum<6>(dw);
+		case 7: return stencilSum<7>(dw);
+		case 8: return stencilSum<8>(dw);
+	}
+
+	// generic case:
+	T out = dw.weights[0] * getData(dw.domain[0]);
+	for(unsigned int i = 1; i < dw.domain.size(); i++){
+		out += dw.weights[i] * getData(dw.domain[i]);
+	}
+	return out;
+}
+
+template <class T>
+template <int N>
+inline T GenericRFunction<T>::stencilSum(const UnstructuredGrid1D::DerivWeights & dw) const{
+
+	// gather:
+	const T * y[N];
+	for(int i = 0; i < N; i++){
+		y[i] = &data[elementIndex(modi(dw.domain[i]))];
+	}
+
+	return WeightedSum<N, T>::sum(&dw.weights[0],y);
+}
+
+template <class T>
+void GenericRFunction<T>::swap(GenericRFunction<T> & other){
+	if(this != &other){
+		UnstructuredGrid1D::swap(other);
+		std::swap(interpolOrder,other.interpolOrder);
+		std::swap(displayPoints,other.displayPoints);
+		data.swap(other.data);
+	}
+}
+
 template <class T>
 void GenericRFunction<T>::add(double xval, const T & yval){
 	UnstructuredGrid1D::add(xval);
@@ -281,10 +378,11 @@ void GenericRFunction<T>::exportDerivative(GenericRFunction<T> & out, int m, int
 	std::vector<T> yout(size());
 
 	for(unsigned int i = 0; i < size(); i++){
-		yout[i] = GridDifferentiable1D<T>::derivative(xout[i],m,o);
+		yout[i] = GenericRFunction<T>::derivative(xout[i],m,o);
 	}
 
-	out = GenericRFunction<T>(xout,yout,interpolOrder,outName);
+	GenericRFunction<T> res(xout,yout,interpolOrder,outName);
+	out.swap(res);
 }
 
 template <class T>
@@ -71,6 +71,12 @@ public:
 	 */
 	virtual T derivative(double x0I, int m, int o = -1) const;
 
+	/** GridDifferentiable1D: Returns the m-th derivative at x0, locating
+	 * x0 by walking the cursor. Cheap for ascending x0, see
+	 * UnstructuredGrid1D::walkIndex_beforeeq.
+	 */
+	T derivative(double x0, int m, int o, int & cursor) const;
+
 
 protected:
 
@@ -82,6 +88,9 @@ private:
 
 	/// Pointer to the underlying grid
 	UnstructuredGrid1D * grid;
+
+	/// Returns the weighted sum of data over the domain
+	T weightedSum(const UnstructuredGrid1D::DerivWeights & dw) const;
 };
 
 template<class T>
@@ -94,20 +103,32 @@ GridDifferentiable1D<T>::~GridDifferentiable1D(){
 }
 
 template<class T>
-T GridDifferentiable1D<T>::derivative(double x0, int m, int o) const{
+inline T GridDifferentiable1D<T>::derivative(double x0, int m, int o) const{
+	UnstructuredGrid1D::DerivWeights dw;
+	grid->calcDerivWeights(x0,m,o,dw);
+	return weightedSum(dw);
+}
+
+template<class T>
+inline T GridDifferentiable1D<T>::derivative(double x0, int m, int o, int & cursor) const{
+	UnstructuredGrid1D::DerivWeights dw;
+	grid->calcDerivWeights(x0,m,o,dw,&cursor);
+	return weightedSum(dw);
+}
+
+template<class T>
+T GridDifferentiable1D<T>::weightedSum(const UnstructuredGrid1D::DerivWeights & dw) const{
 
 	// prepare:
-	double x                       = grid->modx(x0);
-	std::vector<int> oi                 = grid->getDerivDomain(x,m,o);
-	HashStringTable<double> coeffs = grid->getDerivCoeffs(x,m,o);
-	unsigned int n                 = oi.size() - 1;
+	const std::vector<int> & oi   = dw.domain;
+	const std::vector<double> & w = dw.weights;
 
 	// first point:
-	T out = coeffs[grid->key(x,m,n,0,o)] * getData(oi[0]);
+	T out = w[0] * getData(oi[0]);
 
 	// remaining points of domain:
-	for(unsigned int i = 1; i <= n; i++){
-		out += coeffs[grid->key(x,m,n,i,o)] * getData(oi[i]);
+	for(unsigned int i = 1; i < oi.size(); i++){
+		out += w[i] * getData(oi[i]);
 	}
 
 	return out;
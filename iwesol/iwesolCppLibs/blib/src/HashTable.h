@@ -42,6 +42,7 @@ References
 #ifndef HASHTABLE_H_
 #define HASHTABLE_H_
 
+#include <iostream>
 
 #include "Memorizing.h"
 
@@ -87,14 +88,14 @@ template<class T, class U>
 inline T & HashTable<T,U>::operator[](const U & label){
 		int i = Memorizing<T,U>::find(label);
 		if(i < 0) __spitError(label);
-		return Memorizing<T,U>::getMemData(Memorizing<T,U>::elementIndex(i));
+		return Memorizing<T,U>::getMemData(i);
 }
 
 template<class T, class U>
 inline const T & HashTable<T,U>::operator[](const U & label) const {
 		int i = Memorizing<T,U>::find(label);
 		if(i < 0) __spitError(label);
-		return Memorizing<T,U>::getMemData(Memorizing<T,U>::elementIndex(i));
+		return Memorizing<T,U>::getMemData(i);
 }
 
 template<class T, class U>
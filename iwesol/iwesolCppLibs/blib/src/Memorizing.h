@@ -43,20 +43,41 @@ References
 #define MEMORIZING_H_
 
 #include <vector>
-#include "OrderedSet.h"
+#include <string>
+#include <algorithm>
 
 namespace blib{
 
+/// Hash of a string label, FNV-1a
+inline unsigned int memorizingHash(const std::string & label){
+	unsigned int h = 2166136261u;
+	for(unsigned int i = 0; i < label.size(); i++){
+		h = (h ^ (unsigned char)(label[i])) * 16777619u;
+	}
+	return h;
+}
+
+/// Hash of an integer label
+inline unsigned int memorizingHash(int label){
+	unsigned int h = (unsigned int)(label);
+	h = (h ^ (h >> 16)) * 0x7feb352du;
+	h = (h ^ (h >> 15)) * 0x846ca68bu;
+	return h ^ (h >> 16);
+}
+
 /**
  * @class blib::Memorizing
  * @brief An interface for classes that want to store data T under a unique label U.
  *
- * The labels U are ordered.
+ * The labels are hashed into an open addressing table with linear probing,
+ * the entries are stored densely in insertion order. Erasing moves the last
+ * entry into the gap.
  *
+ * Note: A global function 'unsigned int memorizingHash(const U & label)' must be provided for U,
+ * and U must be comparable via == and <.
  */
 template <class T, class U>
-class Memorizing:
-	public OrderedSet<U>{
+class Memorizing{
 
 public:
 
@@ -72,22 +93,20 @@ public:
 	/// Destructor.
 	virtual ~Memorizing(){}
 
-	/// OrderedSet: Returns element i before ordering
-	const U & getUnorderedElement(int i) const { return __memLabels[i]; }
+	/// Exchanges the memory with another one, in O(1)
+	void swap(Memorizing<T,U> & other);
 
-	/// Ordered: Clear memory.
-	virtual void clearMemory() { __memData.clear(); __memLabels.clear(); OrderedSet<U>::clearMemory(); }
+	/// Clear memory.
+	virtual void clearMemory() { __memData.clear(); __memLabels.clear(); __slots.clear(); fillSize = 0; }
 
-	/** Ordered: Specification of the dimension of the problem,
-	 * ie., the number of elements to be ordered.
-	 */
+	/// The number of memorized entries
 	inline unsigned int size() const { return fillSize; }
 
 	/// The current storage size
 	inline unsigned int storageSize() const { return __memLabels.size(); }
 
 	/// resize storage size
-	inline void resize(const int size) { __memLabels.resize(size); __memData.resize(size); }
+	void resize(const int size);
 
 	/// Erases an entry.
 	void erase(const U & label);
@@ -98,11 +117,17 @@ public:
 	/// Recall data from memory.
 	bool recall(T & data, const U & label) const;
 
+	/// Returns the storage index of a label, or -1 if not found
+	int find(const U & label) const;
+
+	/// checks if a label is memorized
+	inline bool found(const U & label) const { return find(label) >= 0; }
+
 	/// Return emptiness.
-	inline bool empty() { return __memLabels.empty(); }
+	inline bool empty() const { return fillSize == 0; }
 
 	/// Returns the ordered labels.
-	inline std::vector<U> getLabels() const { return OrderedSet<U>::getElements(); }
+	std::vector<U> getLabels() const;
 
 	/// Returns a data entry.
 	inline const T & getMemData(const int i) const { return __memData[i]; }
@@ -110,7 +135,7 @@ public:
 	/// Returns a label.
 	inline const U & getMemLabel(const int i) const { return __memLabels[i]; }
 
-	/// Returns the labels.
+	/// Returns the labels, in storage order.
 	inline const std::vector<U> & getMemLables() const { return __memLabels; }
 
 
@@ -128,9 +153,21 @@ private:
 	/// The label container.
 	std::vector<U> __memLabels;
 
+	/// The hash slots, pointing to storage indices or -1 if empty. Size is a power of two.
+	std::vector<int> __slots;
+
 	/// fill size
 	unsigned int fillSize;
 
+	/// Returns the home slot of a label
+	inline unsigned int __homeSlot(const U & label) const { return memorizingHash(label) & (__slots.size() - 1); }
+
+	/// Returns the slot of a label, or the empty slot where it belongs
+	unsigned int __findSlot(const U & label) const;
+
+	/// Rebuilds the hash slots with given size
+	void __rehash(unsigned int slots);
+
 };
 
 template <class T,class U>
@@ -138,7 +175,6 @@ Memorizing<T,U>::Memorizing(int size):
 	__memData(size),
 	__memLabels(size),
 	fillSize(0){
-	Ordered::orderInit();
 }
 
 template <class T,class U>
@@ -146,43 +182,126 @@ Memorizing<T,U>::Memorizing(
 			const std::vector<T> & data,
 			const std::vector<U> & labels
 			):
-			__memData(data),
-			__memLabels(labels),
-			fillSize(labels.size()){
-	Ordered::orderInit();
+			fillSize(0){
+	__rehash(16);
+	for(unsigned int i = 0; i < labels.size(); i++){
+		memorize(data[i],labels[i]);
+	}
+}
+
+template <class T,class U>
+void Memorizing<T,U>::swap(Memorizing<T,U> & other){
+	__memData.swap(other.__memData);
+	__memLabels.swap(other.__memLabels);
+	__slots.swap(other.__slots);
+	std::swap(fillSize,other.fillSize);
+}
+
+template <class T,class U>
+unsigned int Memorizing<T,U>::__findSlot(const U & label) const{
+
+	// linear probing:
+	unsigned int mask = __slots.size() - 1;
+	unsigned int s    = __homeSlot(label);
+	while(__slots[s] >= 0 && !(__memLabels[__slots[s]] == label)){
+		s = (s + 1) & mask;
+	}
+
+	return s;
+}
+
+template <class T,class U>
+void Memorizing<T,U>::__rehash(unsigned int slots){
+
+	// prepare:
+	__slots.assign(slots,-1);
+	unsigned int mask = slots - 1;
+
+	// insert all entries:
+	for(unsigned int i = 0; i < fillSize; i++){
+		unsigned int s = __homeSlot(__memLabels[i]);
+		while(__slots[s] >= 0) s = (s + 1) & mask;
+		__slots[s] = i;
+	}
+}
+
+template <class T,class U>
+inline int Memorizing<T,U>::find(const U & label) const{
+	if(fillSize == 0) return -1;
+	return __slots[__findSlot(label)];
+}
+
+template <class T,class U>
+void Memorizing<T,U>::resize(const int size){
+	__memLabels.resize(size);
+	__memData.resize(size);
+	if(size < int(fillSize)){
+		fillSize = size;
+		__rehash(__slots.size());
+	}
 }
 
 template <class T,class U>
 void Memorizing<T,U>::erase(const U & label){
 
-	// find index:
-	const int l = find(label);
+	// find slot:
+	if(fillSize == 0) return;
+	unsigned int hole = __findSlot(label);
+	const int l       = __slots[hole];
 	if(l < 0) return;
 
-	// erase:
-	__memData.erase(__memData.begin() + l);
-	__memLabels.erase(__memLabels.begin() + l);
-	Ordered::orderEraseEl(l);
+	// backward shift deletion of the slot:
+	unsigned int mask = __slots.size() - 1;
+	unsigned int j    = hole;
+	while(true){
+		j = (j + 1) & mask;
+		if(__slots[j] < 0) break;
+		unsigned int home = __homeSlot(__memLabels[__slots[j]]);
+		bool inRange      = hole <= j ? (home > hole && home <= j) : (home > hole || home <= j);
+		if(!inRange){
+			__slots[hole] = __slots[j];
+			hole          = j;
+		}
+	}
+	__slots[hole] = -1;
+
+	// move last entry into the gap:
+	const int last = fillSize - 1;
+	if(l != last){
+		__slots[__findSlot(__memLabels[last])] = l;
+		__memData[l]   = __memData[last];
+		__memLabels[l] = __memLabels[last];
+	}
+	fillSize--;
 
 }
 
 template <class T,class U>
 bool Memorizing<T,U>::memorize(const T & data, const U & label){
 
-	const int i = OrderedSet<U>::find(label);
-	if(i < 0){
-		if(fillSize < __memLabels.size()){
-			__memData[fillSize]   = data;
-			__memLabels[fillSize] = label;
-		} else {
-			__memData.push_back(data);
-			__memLabels.push_back(label);
-		}
-		fillSize++;
-		return Ordered::orderRegNewEl();
+	// grow, keeping the load factor below 1/2:
+	if(2 * (fillSize + 1) > __slots.size()){
+		__rehash(__slots.size() < 16 ? 16 : 2 * __slots.size());
+	}
+
+	// case known label:
+	unsigned int s = __findSlot(label);
+	if(__slots[s] >= 0){
+		__memData[__slots[s]] = data;
+		return true;
+	}
+
+	// new entry:
+	if(fillSize < __memLabels.size()){
+		__memData[fillSize]   = data;
+		__memLabels[fillSize] = label;
 	} else {
-		__memData[Ordered::elementIndex(i)] = data;
+		__memData.push_back(data);
+		__memLabels.push_back(label);
 	}
+	__slots[s] = fillSize;
+	fillSize++;
+
 	return true;
 }
 
@@ -190,13 +309,19 @@ template <class T,class U>
 inline bool Memorizing<T,U>::recall(T & data, const U & label) const{
 
 	// find index:
-	const int l = OrderedSet<U>::find(label);
+	const int l = find(label);
 	if(l < 0) return false;
 
-	data = __memData[Ordered::elementIndex(l)];
+	data = __memData[l];
 	return true;
 }
 
+template <class T,class U>
+std::vector<U> Memorizing<T,U>::getLabels() const{
+	std::vector<U> out(__memLabels.begin(),__memLabels.begin() + fillSize);
+	std::sort(out.begin(),out.end());
+	return out;
+}
 
 }
 
@@ -33,6 +33,7 @@ License
 \*---------------------------------------------------------------------------*/
 
 #include <iostream>
+#include <algorithm>
 using namespace std;
 
 #include "Ordered.h"
@@ -40,6 +41,24 @@ using namespace std;
 
 namespace blib{
 
+/// Comparison via Ordered::i_before_j, for the standard sort algorithms
+class OrderedBefore{
+
+public:
+
+	/// Constructor
+	OrderedBefore(const Ordered & ordered): ordered(ordered) {}
+
+	/// Returns if i is before j
+	inline bool operator()(int i, int j) const { return ordered.i_before_j(i,j); }
+
+
+private:
+
+	/// The ordered object
+	const Ordered & ordered;
+};
+
 Ordered::Ordered(const string & name) :
 	name(name)
 	{
@@ -64,19 +83,27 @@ void Ordered::orderInit() {
 
 void Ordered::order() {
 
-	// pre-check that n_order is not empty:
-	if (n_order.empty()) {
-		orderInit();
-		if (n_order.empty())
-			return;
+	// prepare:
+	vector<int> sorted(size());
+	for(unsigned int i = 0; i < sorted.size(); i++){
+		sorted[i] = i;
 	}
 
-	__mergesort();
+	// sort, equal elements keep their numbering:
+	stable_sort(sorted.begin(),sorted.end(),OrderedBefore(*this));
 
-	__calcMap_n2i();
+	orderSet(sorted);
 
 }
 
+void Ordered::orderSet(const vector<int> & sorted){
+	n_order.resize(sorted.size());
+	map_n2i = sorted;
+	for(unsigned int n = 0; n < sorted.size(); n++){
+		n_order[sorted[n]] = n;
+	}
+}
+
 void Ordered::orderPrint(){
 
 	vector<int>::iterator it = n_order.begin();
@@ -109,8 +136,8 @@ bool Ordered::orderEraseEl(int deli){
 			int hn = n < deln ? n : n - 1;
 			int hi = map_n2i[n] < deli ? map_n2i[n] : map_n2i[n] - 1;
 
-			neworder[hn]   = hi;
-			newmap_n2i[hi] = hn;
+			neworder[hi]   = hn;
+			newmap_n2i[hn] = hi;
 
 		}
 	}
@@ -134,8 +161,15 @@ bool Ordered::orderRegNewEl(){
 		return true;
 	}
 
-	// find position where to enter the element i = size() - 1:
+	// fast append behind the last element:
 	int newi = size() - 1;
+	if(i_after_j(newi,map_n2i.back())){
+		n_order.push_back(orderSize());
+		map_n2i.push_back(newi);
+		return true;
+	}
+
+	// find position where to enter the element i = size() - 1:
 	int n = enterWhere(newi,0,orderSize() - 1);
 
 	// insert:
@@ -143,9 +177,7 @@ bool Ordered::orderRegNewEl(){
 	for(int i = 0; i < newi; i++){
 		if(n_order[i] >= n) n_order[i]++;
 	}
-
-	// recalc inverse:
-	__calcMap_n2i();
+	map_n2i.insert(map_n2i.begin() + n,newi);
 
 	return true;
 }
@@ -163,71 +195,6 @@ void Ordered::__calcMap_n2i(){
 
 }
 
-/* Code based on
- * http://www.cprogramming.com/tutorial/computersciencetheory/merge.html,
- * adopted to vector<int> and 'i_before_j'
- */
-void Ordered::__merge_helper(int left, int right, vector<int> & scratch) {
-
-	vector<int> & input = n_order;
-
-	/* base case: one element */
-	if (right == left + 1) {
-		return;
-	} else {
-		int i = 0;
-		int length = right - left;
-		int midpoint_distance = length / 2;
-		/* l and r are to the positions in the left and right subarrays */
-		int l = left, r = left + midpoint_distance;
-
-		/* sort each subarray */
-		__merge_helper(left, left + midpoint_distance, scratch);
-		__merge_helper(left + midpoint_distance, right, scratch);
-
-		/* merge the arrays together using scratch for temporary storage */
-		for (i = 0; i < length; i++) {
-			/* Check to see if any elements remain in the left array; if so,
-			 * we check if there are any elements left in the right array; if
-			 * so, we compare them.  Otherwise, we know that the merge must
-			 * use take the element from the left array */
-			if (l < left + midpoint_distance && (r == right ||
-			//max(input[l],input[r]) == input[l]
-					i_before_j(input[l], input[r]))) {
-				scratch[i] = input[l];
-				l++;
-			} else {
-				scratch[i] = input[r];
-				r++;
-			}
-		}
-		/* Copy the sorted subarray back to the input */
-		for (i = left; i < right; i++) {
-			input[i] = scratch[i - left];
-		}
-	}
-}
-
-/* Code based on
- * http://www.cprogramming.com/tutorial/computersciencetheory/merge.html,
- * adopted to vector<int>
- */
-int Ordered::__mergesort() {
-
-	if (n_order.empty())
-		return 0;
-
-	vector<int> & input = n_order;
-
-	unsigned int size = input.size();
-	vector<int> scratch(size);
-
-	__merge_helper(0, size, scratch);
-
-	return 1;
-
-}
-
 int Ordered::enterWhere(int i, int nmin, int nmax) const {
 
 	// simple checks:
@@ -248,6 +215,13 @@ int Ordered::enterWhere(int i, int nmin, int nmax) const {
 	return enterWhere(i,nmid + 1,nmax);
 }
 
+void Ordered::orderSwap(Ordered & other){
+	std::swap(dim,other.dim);
+	name.swap(other.name);
+	n_order.swap(other.n_order);
+	map_n2i.swap(other.map_n2i);
+}
+
 void Ordered::orderRotate(int d){
 
 	// check:
@@ -97,6 +97,7 @@ public:
 	/** Please call after adding an element to the
 	 * end of the data vector, data[size()-1];
 	 * performs the ordering. Returns success.
+	 * Appending behind the last element is O(1).
 	 */
 	bool orderRegNewEl();
 
@@ -106,13 +107,19 @@ public:
 	/// Call after shifting the ordered elements by d entries
 	void orderRotate(int d);
 
+	/// Exchanges the order with another one, in O(1)
+	void orderSwap(Ordered & other);
+
+	/// Reserves storage for n elements
+	inline void orderReserve(unsigned int n) { n_order.reserve(n); map_n2i.reserve(n); }
+
 	/// Initialization.
 	void orderInit();
 
 	/** Calculates the order wrt the method 'i_before_j',
-	 * based on a merge sort
+	 * based on a stable sort
 	 */
-	void order();
+	virtual void order();
 
 	/// Prints the current order
 	void orderPrint();
@@ -173,26 +180,11 @@ protected:
 	/// Finds where to enter the element i into the list
 	int enterWhere(int i, int nmin, int nmax) const;
 
+	/// Sets the order from the list of element indices in ascending order
+	void orderSet(const std::vector<int> & sorted);
 
-private:
 
-	/** left is the index of the leftmost element of the subarray; right is one
-	 * past the index of the rightmost element.
-	 *
-	 * Code based on
-	 * http://www.cprogramming.com/tutorial/computersciencetheory/merge.html,
-	 * adopted to vector<int> and i_before_j
-	 */
-	void __merge_helper(int left, int right, std::vector<int> & scratch);
-
-	/** mergesort returns true on success.
-	 * Elements are sorted in reverse order -- greatest to least
-	 *
-	 * Code based on
-	 * http://www.cprogramming.com/tutorial/computersciencetheory/merge.html,
-	 * adopted to vector<int>
-	 */
-	int __mergesort();
+private:
 
 	/// Inverts n_order
 	void __calcMap_n2i();
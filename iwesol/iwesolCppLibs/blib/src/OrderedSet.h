@@ -42,6 +42,9 @@ References
 #ifndef ORDEREDSET_H_
 #define ORDEREDSET_H_
 
+#include <algorithm>
+#include <utility>
+
 #include "Ordered.h"
 
 namespace blib {
@@ -105,6 +108,9 @@ public:
 		 */
 		int getIndex_aftereq(const T & lowx, int ilow = 0, int ihigh = -1) const;
 
+		/// Ordered: Calculates the order, comparing the elements directly
+		void order();
+
 		/// prints the ordered list
 		void printOrderedSet() const;
 
@@ -174,6 +180,26 @@ int OrderedSet<T>::getIndex_after(const T & lowx, int ilow, int ihigh) const{
 
 }
 
+template <class T>
+void OrderedSet<T>::order(){
+
+	// gather elements once:
+	std::vector< std::pair<T,int> > els(size());
+	for(unsigned int i = 0; i < els.size(); i++){
+		els[i] = std::make_pair(getUnorderedElement(i),int(i));
+	}
+
+	// sort, equal elements keep their numbering:
+	std::sort(els.begin(),els.end());
+
+	// set order:
+	std::vector<int> sorted(els.size());
+	for(unsigned int n = 0; n < els.size(); n++){
+		sorted[n] = els[n].second;
+	}
+	orderSet(sorted);
+}
+
 template <class T>
 void OrderedSet<T>::printOrderedSet() const{
 	for(unsigned int i = 0; i < size(); i++){
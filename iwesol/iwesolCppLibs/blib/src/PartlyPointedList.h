@@ -97,6 +97,9 @@ public:
 	/// The operator =
 	PartlyPointedList<T> & operator=(const PartlyPointedList<T> &rhs);
 
+	/// Exchanges the content with another list in O(1), pointers to local elements stay valid
+	void swap(PartlyPointedList<T> & other);
+
 	/// returns the first element
 	T & first() { return *(elements[0]); }
 
@@ -127,6 +130,9 @@ protected:
 	/// returns from where is pointed to local element
 	const std::vector<int> & getElementsLocalIndices() const { return pointedBy; }
 
+	/// removes all locally stored elements, only the pointed elements remain
+	void clearLocal();
+
 
 private:
 
@@ -136,6 +142,9 @@ private:
 	/// pointer memory
 	std::vector<int> pointedBy;
 
+	/// resets the pointers to the locally stored elements
+	void __fixPointers();
+
 };
 
 template<class T>
@@ -161,9 +170,7 @@ PartlyPointedList<T>::PartlyPointedList(const PartlyPointedList<T> & ppl){
 	  _elements = ppl._elements;
 	  elements  = ppl.elements;
 	  pointedBy = ppl.pointedBy;
-	  for(int i = 0; i < int(pointedBy.size());i++){
-		  elements[pointedBy[i]] = &(_elements[i]);
-	  }
+	  __fixPointers();
 }
 
 template<class T>
@@ -172,18 +179,32 @@ PartlyPointedList<T> & PartlyPointedList<T>::operator=(const PartlyPointedList<T
 		  _elements = rhs._elements;
 		  elements  = rhs.elements;
 		  pointedBy = rhs.pointedBy;
-		  for(int i = 0; i < int(pointedBy.size());i++){
-			  elements[pointedBy[i]] = &(_elements[i]);
-		  }
+		  __fixPointers();
 	  }
 	  return *this;
 }
 
+template<class T>
+inline void PartlyPointedList<T>::swap(PartlyPointedList<T> & other){
+	elements.swap(other.elements);
+	_elements.swap(other._elements);
+	pointedBy.swap(other.pointedBy);
+}
+
+template<class T>
+inline void PartlyPointedList<T>::__fixPointers(){
+	for(int i = 0; i < int(pointedBy.size());i++){
+		elements[pointedBy[i]] = &(_elements[i]);
+	}
+}
+
 template<class T>
 inline void PartlyPointedList<T>::append(const T & element){
+	bool realloc = _elements.size() == _elements.capacity();
 	_elements.push_back(element);
 	elements.push_back(&_elements.back());
 	pointedBy.push_back(elements.size() - 1);
+	if(realloc) __fixPointers();
 }
 
 template<class T>
@@ -191,6 +212,27 @@ inline void PartlyPointedList<T>::append(T * element){
 	elements.push_back(element);
 }
 
+template<class T>
+void PartlyPointedList<T>::clearLocal(){
+
+	// prepare:
+	std::vector<bool> isLocal(elements.size(),false);
+	for(unsigned int i = 0; i < pointedBy.size(); i++){
+		isLocal[pointedBy[i]] = true;
+	}
+
+	// keep pointed elements:
+	std::vector<T*> pointed;
+	for(unsigned int i = 0; i < elements.size(); i++){
+		if(!isLocal[i]) pointed.push_back(elements[i]);
+	}
+	elements = pointed;
+
+	// free memory:
+	std::vector<T>().swap(_elements);
+	std::vector<int>().swap(pointedBy);
+}
+
 template<class T>
 std::vector<T> PartlyPointedList<T>::getElements() const{
 	std::vector<T> out(size());
@@ -0,0 +1,227 @@
+/*---------------------------------------------------------------------------*\
+                               |
+  _____        _______ ____    | IWESOL: IWES Open Library
+ |_ _\ \      / / ____/ ___|   |
+  | | \ \ /\ / /|  _| \___ \   | Copyright: Fraunhofer Institute for Wind
+  | |  \ V  V / | |___ ___) |  | Energy and Energy System Technology IWES
+ |___|  \_/\_/  |_____|____/   |
+                               | http://www.iwes.fraunhofer.de
+                               |
+-------------------------------------------------------------------------------
+License
+    This file is part of IWESOL.
+
+    IWESOL is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IWESOL is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with IWESOL. If not, see <http://www.gnu.org/licenses/>.
+
+Class
+    blib::ShortLinePath
+
+Description
+    See below
+
+SourceFiles
+
+References
+	[1] J. Schmidt, C. Peralta, B. Stoevesandt, "Automated Generation of
+	    Structured Meshes for Wind Energy Applications", Proceedings of the
+	    Open Source CFD International Conference, 2012, London, UK
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef SHORTLINEPATH_H_
+#define SHORTLINEPATH_H_
+
+#include <cmath>
+#include <iostream>
+
+namespace blib {
+
+/**
+ * @class blib::ShortLinePath
+ * @brief A non-periodic path of at most N points, parametrized by the path length.
+ *
+ * Evaluates values and tangents like GenericLinePath, i.e., on the same
+ * stencils and to the same orders, but by closed-form Lagrange polynomials
+ * on the stack. Intended for the few control points of spline construction.
+ *
+ * Note: A global function 'double mag(const T& A)' must be provided for T
+ */
+template <class T, int N = 6>
+class ShortLinePath{
+
+public:
+
+	/// Constructor
+	ShortLinePath(int interpolOrder = 4): n(0), interpolOrder(interpolOrder) {}
+
+	/// adds a data point at the end
+	void addPoint(const T & p);
+
+	/// The number of points
+	inline int points() const { return n; }
+
+	/// Return length
+	inline double length() const { return n > 1 ? x[n - 1] - x[0] : 0.; }
+
+	/// Return a point
+	inline const T & getPoint(int i) const { return pts[i]; }
+
+	/// Return s of a point
+	inline double getPointS(int i) const { return x[i] / length(); }
+
+	/// Returns the interpolation order, see GenericRFunction
+	inline int getInterpolOrder() const { return n < interpolOrder ? n - n % 2 : interpolOrder; }
+
+	/// Returns the m-th derivative at s, m = 0, 1, calculated to order o
+	T derivative(double s, int m, int o) const;
+
+	/// Returns the tangent
+	inline T getTangent(double s, int order = 2) const { return derivative(s,1,order); }
+
+	/// Returns the point at position s, 0 <= s <= 1
+	inline T operator[](double s) const { return derivative(s,0,getInterpolOrder()); }
+
+	/// Evaluates the points at each s of sList into the preallocated out
+	template <class SList, class TList>
+	void values(const SList & sList, TList & out) const;
+
+
+private:
+
+	/// The points
+	T pts[N];
+
+	/// The path length at the points
+	double x[N];
+
+	/// The number of points
+	int n;
+
+	/// The interpolation order
+	int interpolOrder;
+
+	/// Finds the stencil [i0, i0 + size) of GenericRFunction at x0
+	void stencil(double x0, int m, int o, int & i0, int & size) const;
+};
+
+template <class T, int N>
+inline void ShortLinePath<T,N>::addPoint(const T & p){
+
+	// check:
+	if(n == N){
+		std::cout << "\nShortLinePath: Error: Exceeding maximal number of points " << N << std::endl;
+		throw;
+	}
+
+	x[n]   = n > 0 ? x[n - 1] + mag(p - pts[n - 1]) : 0.;
+	pts[n] = p;
+	n++;
+}
+
+template <class T, int N>
+void ShortLinePath<T,N>::stencil(double x0, int m, int o, int & i0, int & size) const{
+
+	// find iL, the last point with x <= x0:
+	int iL = -1;
+	while(iL + 1 < n && x[iL + 1] <= x0){
+		iL++;
+	}
+
+	// stencil size and left extent, as in UnstructuredGrid1D::getNearbyPointIntervall:
+	size = m + o;
+	int left;
+	if(iL >= 0 && x[iL] == x0){
+		if(size % 2 == 0 && iL - (size / 2 - 1) >= 0 && iL + (size / 2 - 1) < n){
+			size--;
+		}
+		left = iL - size / 2;
+	} else {
+		if(size % 2 == 1 && iL - ((size - 1) / 2 - 1) >= 0 && iL + (size - 1) / 2 < n){
+			size--;
+		}
+		left = iL - size / 2 + 1;
+	}
+	if(size > n) size = n;
+
+	// shift into the point range:
+	if(left + size > n) left = n - size;
+	if(left < 0) left = 0;
+	i0 = left;
+}
+
+template <class T, int N>
+T ShortLinePath<T,N>::derivative(double s, int m, int o) const{
+
+	// check:
+	if(m < 0 || m > 1){
+		std::cout << "\nShortLinePath: Error: Derivative m = " << m
+				<< " not supported, only m = 0, 1." << std::endl;
+		throw;
+	}
+
+	// trivial case, see GenericLinePath:
+	if(n == 2 && m == 1){
+		return (pts[1] - pts[0]) / length();
+	}
+	if(o < 0) o = n - m;
+
+	// prepare:
+	double x0 = s * length();
+	int i0    = 0;
+	int size  = 0;
+	stencil(x0,m,o,i0,size);
+
+	// Lagrange weights, or their derivative:
+	double w[N];
+	for(int j = i0; j < i0 + size; j++){
+		double lj = 0.;
+		if(m == 0){
+			lj = 1.;
+			for(int k = i0; k < i0 + size; k++){
+				if(k != j) lj *= (x0 - x[k]) / (x[j] - x[k]);
+			}
+		} else {
+			for(int k = i0; k < i0 + size; k++){
+				if(k == j) continue;
+				double p = 1. / (x[j] - x[k]);
+				for(int l = i0; l < i0 + size; l++){
+					if(l != j && l != k) p *= (x0 - x[l]) / (x[j] - x[l]);
+				}
+				lj += p;
+			}
+		}
+		w[j - i0] = lj;
+	}
+
+	// weighted sum:
+	T out = w[0] * pts[i0];
+	for(int j = 1; j < size; j++){
+		out += w[j] * pts[i0 + j];
+	}
+
+	return m == 0 ? out : std::pow(length(),m) * out;
+}
+
+template <class T, int N>
+template <class SList, class TList>
+void ShortLinePath<T,N>::values(const SList & sList, TList & out) const{
+	int o = getInterpolOrder();
+	for(unsigned int i = 0; i < (unsigned int)(sList.size()); i++){
+		out[i] = derivative(sList[i],0,o);
+	}
+}
+
+}
+
+#endif /* SHORTLINEPATH_H_ */
@@ -0,0 +1,202 @@
+/*---------------------------------------------------------------------------*\
+                               |
+  _____        _______ ____    | IWESOL: IWES Open Library
+ |_ _\ \      / / ____/ ___|   |
+  | | \ \ /\ / /|  _| \___ \   | Copyright: Fraunhofer Institute for Wind
+  | |  \ V  V / | |___ ___) |  | Energy and Energy System Technology IWES
+ |___|  \_/\_/  |_____|____/   |
+                               | http://www.iwes.fraunhofer.de
+                               |
+-------------------------------------------------------------------------------
+License
+    This file is part of IWESOL.
+
+    IWESOL is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IWESOL is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with IWESOL. If not, see <http://www.gnu.org/licenses/>.
+
+Class
+    blib::TaskGraph
+
+Description
+    See below
+
+SourceFiles
+
+References
+	[1] J. Schmidt, C. Peralta, B. Stoevesandt, "Automated Generation of
+	    Structured Meshes for Wind Energy Applications", Proceedings of the
+	    Open Source CFD International Conference, 2012, London, UK
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef TASKGRAPH_H_
+#define TASKGRAPH_H_
+
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <iostream>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace blib {
+
+/**
+ * @class blib::TaskGraph
+ * @brief Runs member functions 'bool C::f()' in the order of their declared dependencies.
+ *
+ * The tasks are run in waves: a wave consists of all tasks whose
+ * requirements have finished. A wave with a single task is run
+ * directly, such that its own OpenMP loops keep all threads. The tasks
+ * of a larger wave run concurrently, and their inner loops run nested
+ * with the default team size, such that a short task does not throttle
+ * a long one. Without OpenMP the tasks of a wave run in the order of
+ * their insertion.
+ *
+ * If a task fails, no further wave is started and run() returns false.
+ */
+template <class C>
+class TaskGraph{
+
+public:
+
+	/// The task function type
+	typedef bool (C::*Function)();
+
+	/// Constructor
+	TaskGraph(C & obj): obj(obj) {}
+
+	/// adds a task, returns its label
+	int addTask(const std::string & name, Function f);
+
+	/// declares that task i requires task j to be finished
+	void addRequirement(int i, int j);
+
+	/// runs all tasks. Returns success
+	bool run();
+
+	/// Returns the number of tasks
+	inline int size() const { return int(functions.size()); }
+
+	/// Returns the name of task i
+	inline const std::string & getName(int i) const { return names[i]; }
+
+
+private:
+
+	/// The object
+	C & obj;
+
+	/// The task names
+	std::vector<std::string> names;
+
+	/// The task functions
+	std::vector<Function> functions;
+
+	/// The tasks that are waiting for task i
+	std::vector< std::vector<int> > dependents;
+
+	/// The number of requirements of task i
+	std::vector<int> requirements;
+};
+
+template <class C>
+inline int TaskGraph<C>::addTask(const std::string & name, Function f){
+	names.push_back(name);
+	functions.push_back(f);
+	dependents.push_back(std::vector<int>());
+	requirements.push_back(0);
+	return size() - 1;
+}
+
+template <class C>
+inline void TaskGraph<C>::addRequirement(int i, int j){
+
+	// check:
+	if(i < 0 || j < 0 || i >= size() || j >= size() || i == j){
+		std::cout << "\nTaskGraph: Error: Illegal requirement " << i << " <- " << j << std::endl;
+		throw;
+	}
+
+	dependents[j].push_back(i);
+	requirements[i]++;
+}
+
+template <class C>
+bool TaskGraph<C>::run(){
+
+	// prepare:
+	std::vector<int> missing(requirements);
+	std::vector<int> wave;
+	for(int i = 0; i < size(); i++){
+		if(missing[i] == 0) wave.push_back(i);
+	}
+	int done = 0;
+
+	// loop over waves:
+	while(!wave.empty()){
+
+		// run wave:
+		const int n = int(wave.size());
+		std::vector<char> success(n,0);
+		if(n == 1){
+			success[0] = (obj.*functions[wave[0]])();
+		} else {
+#ifdef _OPENMP
+			const int maxLevels = omp_get_max_active_levels();
+			omp_set_max_active_levels(maxLevels > 2 ? maxLevels : 2);
+			#pragma omp parallel for num_threads(n) schedule(dynamic,1)
+#endif
+			for(int k = 0; k < n; k++){
+				success[k] = (obj.*functions[wave[k]])();
+			}
+#ifdef _OPENMP
+			omp_set_max_active_levels(maxLevels);
+#endif
+		}
+
+		// check:
+		for(int k = 0; k < n; k++){
+			if(!success[k]){
+				std::cout << "\nTaskGraph: Error: Task '" << names[wave[k]] << "' failed." << std::endl;
+				return false;
+			}
+		}
+		done += n;
+
+		// collect next wave:
+		std::vector<int> next;
+		for(int k = 0; k < n; k++){
+			const std::vector<int> & deps = dependents[wave[k]];
+			for(unsigned int d = 0; d < deps.size(); d++){
+				if(--missing[deps[d]] == 0) next.push_back(deps[d]);
+			}
+		}
+		std::sort(next.begin(),next.end());
+		wave.swap(next);
+	}
+
+	// check:
+	if(done != size()){
+		std::cout << "\nTaskGraph: Error: Cyclic requirements, " << size() - done << " tasks not run." << std::endl;
+		return false;
+	}
+
+	return true;
+}
+
+}
+
+#endif /* TASKGRAPH_H_ */
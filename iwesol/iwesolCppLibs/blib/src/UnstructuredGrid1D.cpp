@@ -32,6 +32,9 @@ License
 
 \*---------------------------------------------------------------------------*/
 
+#include <cstring>
+#include <algorithm>
+
 #include "UnstructuredGrid1D.h"
 using namespace std;
 
@@ -63,9 +66,17 @@ UnstructuredGrid1D::~UnstructuredGrid1D() {
 
 int UnstructuredGrid1D::getIndexCellNr(const COORD_GRID & p) const{
 	if(!insideGrid(p) || points.size() < 2) return -1;
-	int out = 0;
-	while(p[0] <= getPoint1D(out + 1)) out++;
-	return out;
+	int out = getIndex_beforeeq(p[0]);
+	return out < cells() ? out : cells() - 1;
+}
+
+void UnstructuredGrid1D::swap(UnstructuredGrid1D & other){
+	points.swap(other.points);
+	std::swap(flag_periodic,other.flag_periodic);
+	std::swap(lastStepX,other.lastStepX);
+	derivCache.swap(other.derivCache);
+	gridName.swap(other.gridName);
+	orderSwap(other);
 }
 
 MultiIndexed::IndexCell UnstructuredGrid1D::getIndexCell(const int cellnr) const{
@@ -205,6 +216,129 @@ HashStringTable<double> UnstructuredGrid1D::calcDerivCoeffs(double x0,int mm,int
 	return derCoeffs;
 }
 
+unsigned int UnstructuredGrid1D::derivCacheSlot(double x0, int m, int o) const{
+
+	// prepare:
+	unsigned char bytes[sizeof(double)];
+	memcpy(bytes,&x0,sizeof(double));
+	unsigned int h = 2166136261u;
+
+	// FNV-1a over the bits of x0, then m and o:
+	for(unsigned int i = 0; i < sizeof(double); i++){
+		h = (h ^ bytes[i]) * 16777619u;
+	}
+	h = (h ^ (unsigned int)(m)) * 16777619u;
+	h = (h ^ (unsigned int)(o)) * 16777619u;
+
+	return (h ^ (h >> 16)) % DERIV_CACHE_SIZE;
+}
+
+int UnstructuredGrid1D::walkIndex_beforeeq(double x, int & cursor) const{
+
+	// check cursor, search if behind x:
+	if(cursor < 0 || cursor >= int(size()) || getPoint1D(cursor) > x){
+		cursor = getIndex_beforeeq(x);
+		return cursor;
+	}
+
+	// walk:
+	while(cursor + 1 < int(size()) && getPoint1D(cursor + 1) <= x){
+		cursor++;
+	}
+
+	return cursor;
+}
+
+const UnstructuredGrid1D::DerivWeights & UnstructuredGrid1D::_getDerivWeights(double x0, int m, int o, int * cursor) const{
+
+	// prepare:
+	double x = modx(x0);
+	if(o < 0) o = size() - m;
+	if(derivCache.empty()) derivCache.resize(DERIV_CACHE_SIZE);
+
+	// check cache:
+	DerivWeights & dw = derivCache[derivCacheSlot(x,m,o)];
+	if(dw.m == m && dw.o == o && dw.x == x) return dw;
+
+	// calculate:
+	dw.x = x;
+	dw.m = m;
+	dw.o = o;
+	calcDerivWeights(dw,cursor ? walkIndex_beforeeq(x,*cursor) : getIndex_beforeeq(x));
+
+	return dw;
+}
+
+void UnstructuredGrid1D::calcDerivWeights(double x0, int m, int o, DerivWeights & dw, int * cursor) const{
+
+	// prepare:
+	dw.x = modx(x0);
+	dw.m = m;
+	dw.o = o < 0 ? size() - m : o;
+
+	// calculate:
+	calcDerivWeights(dw,cursor ? walkIndex_beforeeq(dw.x,*cursor) : getIndex_beforeeq(dw.x));
+}
+
+void UnstructuredGrid1D::calcDerivWeights(DerivWeights & dw, int iL) const{
+
+	// calculate domain:
+	dw.domain = getNearbyPointIntervall(dw.x,dw.m,dw.o,iL);
+
+	// prepare:
+	const vector<int> & oi = dw.domain;
+	int N                  = oi.size();
+	int M                  = dw.m;
+	double x               = dw.x;
+	dw.weights.assign(N,0.);
+	if(N == 0 || M < 0) return;
+
+	// node positions:
+	vector<double> xn(N);
+	for(int i = 0; i < N; i++){
+		xn[i] = _findXPeriodic(oi[i]);
+	}
+
+	// flat table of delta(k,n,nu) at c[k * N + nu], updated in place:
+	vector<double> c((M + 1) * N, 0.);
+	c[0]      = 1.;
+	double c1 = 1.;
+	for(int n = 1; n < N; n++){
+
+		// prepare:
+		int mmax  = n <= M ? n : M;
+		double c2 = 1.;
+		for(int nu = 0; nu < n; nu++){
+			c2 *= xn[n] - xn[nu];
+		}
+
+		// new point, from the previous point:
+		for(int k = mmax; k >= 0; k--){
+			double cm    = k > 0 ? c[(k - 1) * N + n - 1] : 0.;
+			c[k * N + n] = c1 / c2 * (
+					k * cm - (xn[n - 1] - x) * c[k * N + n - 1]
+					);
+		}
+
+		// update previous points, k descending keeps delta(k - 1) of step n - 1:
+		for(int nu = 0; nu < n; nu++){
+			double c3 = xn[n] - xn[nu];
+			for(int k = mmax; k >= 0; k--){
+				double cm     = k > 0 ? c[(k - 1) * N + nu] : 0.;
+				c[k * N + nu] = (
+						(xn[n] - x) * c[k * N + nu] - k * cm
+						) / c3;
+			}
+		}
+
+		c1 = c2;
+	}
+
+	// copy weights of m-th derivative:
+	for(int nu = 0; nu < N; nu++){
+		dw.weights[nu] = c[M * N + nu];
+	}
+}
 
 void UnstructuredGrid1D::_getPointIntervall(vector<int> & intervall, int iL, int iR) const{
 
@@ -349,14 +483,18 @@ vector<int> UnstructuredGrid1D::getNearbyPointIntervall_int(int x0I, int m, int
 
 vector<int> UnstructuredGrid1D::getNearbyPointIntervall(double x0, int m, int o) const{
 
-	// check order:
-	if(o < 0) return getNearbyPointIntervall(x0,m,size() - m);
-
 	// prepare:
 	double x = modx(x0);
 
+	return getNearbyPointIntervall(x,m,o,getIndex_beforeeq(x));
+}
+
+vector<int> UnstructuredGrid1D::getNearbyPointIntervall(double x, int m, int o, int iL) const{
+
+	// check order:
+	if(o < 0) return getNearbyPointIntervall(x,m,size() - m,iL);
+
 	// check if point is listed:
-	int iL = getIndex_beforeeq(x);
 	if(iL >= 0 && getPoint1D(iL) == x){
 		return getNearbyPointIntervall_int(iL,m,o);
 	}
@@ -463,6 +601,7 @@ void UnstructuredGrid1D::shift(double deltax){
 		// shift:
 		points[elementIndex(i)] = newx;
 	}
+	clearDerivCache();
 
 	// rotate order:
 	if(isPeriodic()){
@@ -88,6 +88,12 @@ public:
 	/// UnstructuredGrid1D: erases element i
 	virtual void erase(int i);
 
+	/// Exchanges points, order and name with another grid, in O(1)
+	void swap(UnstructuredGrid1D & other);
+
+	/// Reserves storage for n points
+	inline void reserve(unsigned int n) { points.reserve(n); orderReserve(n); }
+
 	/// OrderedSet: Returns element i before ordering
 	inline const double & getUnorderedElement(int i) const { return points[modi(i)]; }
 
@@ -144,6 +150,40 @@ public:
 	/// interpolating at x0, possibly different from grid points
 	HashStringTable<double> getDerivCoeffs(double x0,int m, int o = -1) const;
 
+	/// struct for flat derivative weights, see getDerivWeights
+	struct DerivWeights{
+		DerivWeights(): x(0), m(-1), o(0) {}
+		double x;
+		int m;
+		int o;
+		std::vector<int> domain;
+		std::vector<double> weights;
+	};
+
+	/** Returns the domain and the flat derivative weights for the m-th
+	 * derivative at x0, such that
+	 *
+	 * 			d^m f / dx^m = sum_{i} weights[i] * f(domain[i]).
+	 *
+	 * The result is cached per (x0, m, o) until the grid changes, and
+	 * the reference is valid until the next call. Not thread-safe, since
+	 * the cache is shared; the derivative evaluations therefore use
+	 * calcDerivWeights.
+	 */
+	const DerivWeights & getDerivWeights(double x0, int m, int o = -1) const;
+
+	/// as above, but locating x0 by walking the cursor, see walkIndex_beforeeq
+	const DerivWeights & getDerivWeights(double x0, int m, int o, int & cursor) const;
+
+	/// as getDerivWeights, but into caller-owned storage and without the cache. cursor may be 0.
+	void calcDerivWeights(double x0, int m, int o, DerivWeights & dw, int * cursor = 0) const;
+
+	/** Returns index of closest point <= x, walking forward from the cursor
+	 * and updating it. Amortised O(1) for ascending x, otherwise falls back
+	 * to a binary search. Returns -1 if impossible.
+	 */
+	int walkIndex_beforeeq(double x, int & cursor) const;
+
 	/** Key for coefficient table, see
 	 * http://amath.colorado.edu/faculty/fornberg/Docs/MathComp_88_FD_formulas.pdf
 	 */
@@ -167,10 +207,10 @@ public:
 	void printDerivCoeffs(double x0, int m, int o) const;
 
 	/// set periodicity
-	inline void setPeriodic(double lastStepSizeX){ flag_periodic = true; lastStepX = lastStepSizeX; }
+	inline void setPeriodic(double lastStepSizeX){ flag_periodic = true; lastStepX = lastStepSizeX; clearDerivCache(); }
 
 	/// unset periodicity
-	inline void unsetPeriodic(){ flag_periodic = false; lastStepX = 0; }
+	inline void unsetPeriodic(){ flag_periodic = false; lastStepX = 0; clearDerivCache(); }
 
 	/// returns periodicity
 	inline bool isPeriodic() const { return flag_periodic; }
@@ -199,6 +239,9 @@ protected:
 	/// the last step size for periodic case
 	double lastStepX;
 
+	/// clears the derivative weights cache, call whenever points change
+	inline void clearDerivCache() const { derivCache.clear(); }
+
 
 	/** Calculates the derivative coefficients at x0, a la
 	 * http://amath.colorado.edu/faculty/fornberg/Docs/MathComp_88_FD_formulas.pdf
@@ -209,12 +252,30 @@ protected:
 
 private:
 
+	/// The number of slots in the derivative weights cache
+	static const unsigned int DERIV_CACHE_SIZE = 16;
+
+	/// The derivative weights cache, direct mapped by (x0, m, o)
+	mutable std::vector<DerivWeights> derivCache;
+
+	/// Calculates the flat derivative weights for dw.x, dw.m, dw.o, a la [2], given iL = getIndex_beforeeq(dw.x)
+	void calcDerivWeights(DerivWeights & dw, int iL) const;
+
+	/// Returns the cache entry for (x0, m, o), calculated if not cached. cursor may be 0.
+	const DerivWeights & _getDerivWeights(double x0, int m, int o, int * cursor) const;
+
+	/// Returns the cache slot for (x0, m, o)
+	unsigned int derivCacheSlot(double x0, int m, int o) const;
+
 	/// Returns intervall of 2N + 1 points around x0
 	std::vector<int> getNearbyPointIntervall_int(int x0, int m, int o) const;
 
 	/// interpolating at x0, possibly different from grid points
 	std::vector<int> getNearbyPointIntervall(double x0, int m, int o) const;
 
+	/// interpolating at x = modx(x0), given iL = getIndex_beforeeq(x)
+	std::vector<int> getNearbyPointIntervall(double x, int m, int o, int iL) const;
+
 	/// defines the point interval
 	void _getPointIntervall(std::vector<int> & intervall, int iL, int iR) const;
 
@@ -230,6 +291,7 @@ inline std::string UnstructuredGrid1D::key(double x0, int m, int n, int i, int o
 inline void UnstructuredGrid1D::add(double x){
 	points.push_back(x);
 	orderRegNewEl();
+	clearDerivCache();
 }
 
 inline double UnstructuredGrid1D::getLastStepSizeX() const {
@@ -263,9 +325,18 @@ inline int UnstructuredGrid1D::modi(int i) const{
 	return modi(i - size());
 }
 
+inline const UnstructuredGrid1D::DerivWeights & UnstructuredGrid1D::getDerivWeights(double x0, int m, int o) const{
+	return _getDerivWeights(x0,m,o,0);
+}
+
+inline const UnstructuredGrid1D::DerivWeights & UnstructuredGrid1D::getDerivWeights(double x0, int m, int o, int & cursor) const{
+	return _getDerivWeights(x0,m,o,&cursor);
+}
+
 inline void UnstructuredGrid1D::erase(int i){
 	points.erase(points.begin() + i);
 	OrderedSet<double>::orderEraseEl(i);
+	clearDerivCache();
 }
 
 
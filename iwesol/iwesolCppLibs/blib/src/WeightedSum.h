@@ -0,0 +1,84 @@
+/*---------------------------------------------------------------------------*\
+                               |
+  _____        _______ ____    | IWESOL: IWES Open Library
+ |_ _\ \      / / ____/ ___|   |
+  | | \ \ /\ / /|  _| \___ \   | Copyright: Fraunhofer Institute for Wind
+  | |  \ V  V / | |___ ___) |  | Energy and Energy System Technology IWES
+ |___|  \_/\_/  |_____|____/   |
+                               | http://www.iwes.fraunhofer.de
+                               |
+-------------------------------------------------------------------------------
+License
+    This file is part of IWESOL.
+
+    IWESOL is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IWESOL is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with IWESOL. If not, see <http://www.gnu.org/licenses/>.
+
+Class
+    blib::WeightedSum
+
+Description
+    See below
+
+SourceFiles
+
+References
+	[1] J. Schmidt, C. Peralta, B. Stoevesandt, "Automated Generation of
+	    Structured Meshes for Wind Energy Applications", Proceedings of the
+	    Open Source CFD International Conference, 2012, London, UK
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef WEIGHTEDSUM_H_
+#define WEIGHTEDSUM_H_
+
+namespace blib {
+
+/**
+ * @class blib::WeightedSum
+ * @brief The weighted sum of N values, sum_{i < N} w[i] * y[i], unrolled at compile time.
+ *
+ * Specialize for T if its components should be summed separately.
+ */
+template <int N, class T>
+class WeightedSum{
+
+public:
+
+	/// Returns the weighted sum
+	static inline T sum(const double * w, const T * const * y){
+		T out = w[0] * *(y[0]);
+		WeightedSum<N - 1, T>::add(out,w + 1,y + 1);
+		return out;
+	}
+
+	/// Adds the weighted sum to out
+	static inline void add(T & out, const double * w, const T * const * y){
+		out += w[0] * *(y[0]);
+		WeightedSum<N - 1, T>::add(out,w + 1,y + 1);
+	}
+};
+
+/// End of recursion
+template <class T>
+class WeightedSum<0, T>{
+
+public:
+
+	/// Adds nothing
+	static inline void add(T &, const double *, const T * const *){}
+};
+
+}
+
+#endif /* WEIGHTEDSUM_H_ */